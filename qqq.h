@@ -71,8 +71,18 @@ typedef
     void *,                            //arbitrary arguments passed from TASK_NEW
     machine_intu_t);
 
+typedef struct {                       //run time statistics of one task
+  machine_intu_t id;                   //task ID
+  int32u_t runtime;                    //total time run, TASK_STAT_CLOCK ticks
+  int32u_t nrun;                       //number of times the task was run
+  machine_intu_t maxslice;             //longest single time slice, clock ticks
+  machine_intu_t stkfree;              //stack bytes never used
+  } task_stat_t;
+
 //   Functions.
 //
+void task_block (void);                //block this task until unblocked
+
 machine_intu_t                         //true or false
 task_exist (                           //check whether a task exists
   machine_intu_t);                     //task ID
@@ -104,12 +114,33 @@ machine_intu_t                         //task ID, undefined for out of range slo
 task_nid (                             //get ID of task in a particular slot
   machine_intu_t);                     //0 to TASK_N_CURR-1 task slot number
 
+machine_intu_t                         //priority of the current task
+task_prio (void);
+
+void task_prio_set (                   //set priority of the current task
+  machine_intu_t);                     //0-32767 priority, higher runs first
+
 void task_prune (                      //kill all but the first N tasks
   machine_intu_t);                     //number of tasks to leave, 0 resets processor
 
+machine_intu_t                         //true iff slot number valid
+task_stat (                            //get run time statistics of a task
+  machine_intu_t,                      //0 to TASK_N_CURR-1 task slot number
+  task_stat_t *);                      //returned statistics
+
+void task_stat_reset (void);           //reset run time statistics of all tasks
+
 machine_intu_t                         //non-zero iff task should yield now
 task_time_done (void);                 //checks for time slice elapsed
 
+void task_unblock (                    //allow a blocked task to run again
+  machine_intu_t);                     //ID of the task to unblock, ignored if invalid
+
+void task_wait (                       //run other tasks while condition is true
+  volatile void *,                     //address of word to check
+  machine_intu_t,                      //mask of bits to check
+  machine_intu_t);                     //wait while masked bits have this value
+
 void task_yield (void);                //let other tasks run for a while
 
 machine_intu_t                         //non-zero iff did yield
@@ -119,6 +150,17 @@ task_yield_iftime (void);              //yield if time slice elapsed
 //
 //   Dynamic memory allocation and deallocation.
 //
+typedef struct {                       //heap fragmentation information
+  machine_intu_t total;                //total free bytes
+  machine_intu_t largest;              //size of largest free region, bytes
+  machine_intu_t nfree;                //number of separate free regions
+  machine_intu_t frag;                 //0-100 percent free mem not in largest region
+  } dymem_frag_t;
+
+void * *                               //handle to the new mem, NULL on failure
+dymem_alloc_hand (                     //allocate relocatable mem, access thru handle
+  int16u_t);                           //size of new memory to allocate, bytes
+
 void *                                 //pointer to start of the new memory
 dymem_alloc_perm (                     //permanently alloc mem from heap, no dealloc
   int16u_t);                           //size of new memory to allocate, bytes
@@ -127,21 +169,65 @@ void *                                 //pointer to start of the new memory
 dymem_alloc_temp (                     //allocate new mem from heap, can dealloc
   int16u_t);                           //size of new memory to allocate, bytes
 
+void dymem_compact (void);             //move relocatable mem to close up heap gaps
+
 void dymem_dealloc (                   //deallocate temporarily allocated memory
   void *);                             //pointer to anywhere in region to dealloc
 
+void dymem_dealloc_hand (              //deallocate relocatable mem, release handle
+  void * *);                           //handle returned by DYMEM_ALLOC_HAND
+
+void dymem_frag (                      //get heap fragmentation information
+  dymem_frag_t *);                     //returned information
+
 //******************************************************************************
 //
 //   Extended data memory access.
 //
+typedef struct {                       //sequential access position in ext mem
+  machine_intu_t ptr;                  //address within the ext mem window
+  machine_intu_t page;                 //DSRPAG/DSWPAG value for PTR
+  machine_intu_t left;                 //bytes left in the current page
+  } exmem_cur_t;
+
 void exmem_alloc_reset (void);         //reset all extended data mem to unallocated
 
+exmem_adr_t exmem_alloc_mark (void);   //get current allocation state
+
+void exmem_alloc_release (             //dealloc all mem allocated after a mark
+  exmem_adr_t);                        //mark from EXMEM_ALLOC_MARK
+
 int32u_t exmem_alloc_avail (void);     //get amount of ext mem available to allocate
 
 exmem_adr_t                            //adr of new mem, always even, 0 on failure
 exmem_alloc_perm (                     //allocate buffer of extended data memory
   int32u_t);                           //number of bytes to allocate
 
+exmem_adr_t                            //adr of new mem, always even, 0 on failure
+exmem_arena_alloc (                    //allocate buffer from a arena
+  int32u_t,                            //number of bytes to allocate
+  machine_intu_t);                     //arena ID
+
+int32u_t                               //bytes left to allocate, 0 for no arena
+exmem_arena_avail (                    //get amount of mem available in a arena
+  machine_intu_t);                     //arena ID
+
+void exmem_arena_clear (               //dealloc all mem allocated from a arena
+  machine_intu_t);                     //arena ID
+
+exmem_adr_t                            //allocation state, 0 for invalid arena ID
+exmem_arena_mark (                     //get current allocation state of a arena
+  machine_intu_t);                     //arena ID
+
+exmem_adr_t                            //start address of the arena, 0 on failure
+exmem_arena_new (                      //create a arena
+  int32u_t,                            //size of the arena, bytes
+  machine_intu_t);                     //0 to EXMEM_NARENAS-1 arena ID
+
+void exmem_arena_release (             //dealloc arena mem allocated after a mark
+  exmem_adr_t,                         //mark from EXMEM_ARENA_MARK
+  machine_intu_t);                     //arena ID
+
 int8u_t
 exmem_get8u (                          //read 8-bit unsigned integer from ext mem
   exmem_adr_t);                        //ext mem address to read from
@@ -178,6 +264,66 @@ float
 exmem_getfp32 (                        //read 32-bit floating point from ext mem
   exmem_adr_t);                        //ext mem address to read from
 
+exmem_adr_t                            //current ext mem address of the cursor
+exmem_cur_adr (
+  exmem_cur_t *);                      //the cursor
+
+int8u_t
+exmem_cur_get8u (                      //read 8-bit unsigned integer at cursor, advance
+  exmem_cur_t *);                      //the cursor
+
+int16u_t
+exmem_cur_get16u (                     //read 16-bit unsigned integer at cursor, advance
+  exmem_cur_t *);                      //the cursor
+
+int16s_t
+exmem_cur_get16s (                     //read 16-bit signed integer at cursor, advance
+  exmem_cur_t *);                      //the cursor
+
+int32u_t
+exmem_cur_get32u (                     //read 32-bit unsigned integer at cursor, advance
+  exmem_cur_t *);                      //the cursor
+
+int32s_t
+exmem_cur_get32s (                     //read 32-bit signed integer at cursor, advance
+  exmem_cur_t *);                      //the cursor
+
+float
+exmem_cur_getfp32 (                    //read 32-bit floating point at cursor, advance
+  exmem_cur_t *);                      //the cursor
+
+void exmem_cur_open (                  //set cursor to ext mem address
+  exmem_adr_t,                         //ext mem address
+  exmem_cur_t *);                      //the cursor to set
+
+void exmem_cur_put8u (                 //write 8-bit unsigned integer at cursor, advance
+  int8u_t,                             //the value to write
+  exmem_cur_t *);                      //the cursor
+
+void exmem_cur_put16u (                //write 16-bit unsigned integer at cursor, advance
+  int16u_t,                            //the value to write
+  exmem_cur_t *);                      //the cursor
+
+void exmem_cur_put32u (                //write 32-bit unsigned integer at cursor, advance
+  int32u_t,                            //the value to write
+  exmem_cur_t *);                      //the cursor
+
+void exmem_cur_putfp32 (               //write 32-bit floating point at cursor, advance
+  float,                               //the value to write
+  exmem_cur_t *);                      //the cursor
+
+void *                                 //updated regular memory address
+exmem_cur_read (                       //copy from ext mem at cursor, advance cursor
+  void *,                              //pointer to destination buffer in regular memory
+  int16u_t,                            //number of bytes to copy
+  exmem_cur_t *);                      //the cursor
+
+void *                                 //updated regular memory address
+exmem_cur_write (                      //copy to ext mem at cursor, advance cursor
+  void *,                              //pointer to source buffer in regular memory
+  int16u_t,                            //number of bytes to copy
+  exmem_cur_t *);                      //the cursor
+
 void exmem_getbuf (                    //read buffer of bytes from extended data memory
   void *,                              //pointer to destination buffer in regular memory
   int16u_t,                            //number of bytes to write